@@ -0,0 +1,640 @@
+/*******************************************************************************
+* Copyright (C) Maxim Integrated Products, Inc., All rights Reserved.
+*
+* This software is protected by copyright laws of the United States and
+* of foreign countries. This material may also be protected by patent laws
+* and technology transfer regulations of the United States and of foreign
+* countries. This software is furnished under a license agreement and/or a
+* nondisclosure agreement and may only be used or reproduced in accordance
+* with the terms of those agreements. Dissemination of this information to
+* any party or parties not specified in the license agreement and/or
+* nondisclosure agreement is expressly prohibited.
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL MAXIM INTEGRATED BE LIABLE FOR ANY CLAIM, DAMAGES
+* OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*
+* Except as contained in this notice, the name of Maxim Integrated
+* Products, Inc. shall not be used except as stated in the Maxim Integrated
+* Products, Inc. Branding Policy.
+*
+* The mere transfer of this software does not imply any licenses
+* of trade secrets, proprietary technology, copyrights, patents,
+* trademarks, maskwork rights, or any other form of intellectual
+* property whatsoever. Maxim Integrated Products, Inc. retains all
+* ownership rights.
+*******************************************************************************
+*/
+
+/**
+* @file mxm_wellness_bench.c
+* @date October 2026
+* @brief Wellness Suite Library benchmark with a synthetic night generator
+*
+* Generates a deterministic synthetic night (25 Hz sensor hub samples with
+* HR, IBI and accelerometer data following a sleep-cycle structure) and
+* times ::mxm_algosuite_manager_run for a set of algorithm configurations.
+* Each scenario runs in a forked child so that its peak RSS is its own;
+* a baseline child runs the generator without the library for reference.
+* With -r each scenario is repeated and the run with the median total time
+* is reported, together with the fastest total time. Results are written
+* as JSON.
+*
+* Usage: mxm_wellness_bench [-h hours] [-n noise_ms] [-c cycle_min]
+*                           [-s seed] [-r repeats] [-o output.json]
+*/
+
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE             /* wait4 */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include "AlgoWrapper.h"
+
+#define BENCH_SAMPLE_PERIOD_MS      40      /**< Sensor hub output period (25 Hz) */
+#define BENCH_SAMPLES_PER_SEC       (1000 / BENCH_SAMPLE_PERIOD_MS)
+#define BENCH_HUB_SCALE             10      /**< HR and IBI are reported in tenths by the sensor hub */
+#define BENCH_ACC_1G                1000    /**< Accelerometer units per g */
+#define BENCH_START_TIMESTAMP_MS    1700000000000ULL
+#define BENCH_MIN_IBI_MS            300.0f  /**< Generated IBIs are clamped to 300-2000 ms (200-30 bpm) */
+#define BENCH_MAX_IBI_MS            2000.0f
+#define BENCH_MAX_NOISE_MS          500.0f  /**< Upper bound for -n */
+/** Longest night whose sample count fits in uint32_t */
+#define BENCH_MAX_HOURS             ((float)(UINT32_MAX / (3600u * BENCH_SAMPLES_PER_SEC)))
+#define BENCH_MAX_REPEATS           99      /**< Upper bound for -r; sizes the per-scenario run array */
+
+#if !defined(__ANDROID__)
+/* The prebuilt archives are linked against the Android log library. */
+int __android_log_print(int prio, const char *tag, const char *fmt, ...)
+{
+    (void)prio;
+    (void)tag;
+    (void)fmt;
+    return 0;
+}
+#endif
+
+/**
+* @brief   Sleep stages used by the synthetic night generator
+*/
+typedef enum _bench_stage {
+    BENCH_STAGE_WAKE,
+    BENCH_STAGE_LIGHT,
+    BENCH_STAGE_DEEP,
+    BENCH_STAGE_REM,
+    BENCH_STAGE_COUNT
+} bench_stage;
+
+/**
+* @brief   Physiological profile of a sleep stage
+*/
+typedef struct _bench_stage_profile {
+    float mean_ibi_ms;      /**< Mean inter-beat interval */
+    float rsa_depth_ms;     /**< Respiratory sinus arrhythmia modulation depth */
+    float motion_mg;        /**< Accelerometer noise amplitude */
+    float motion_burst_prob; /**< Per-sample probability of a movement burst */
+} bench_stage_profile;
+
+static const bench_stage_profile bench_profiles[BENCH_STAGE_COUNT] = {
+    /* WAKE  */ { 850.0f, 25.0f, 60.0f, 0.0200f },
+    /* LIGHT */ { 1000.0f, 40.0f, 4.0f, 0.0010f },
+    /* DEEP  */ { 1090.0f, 55.0f, 2.0f, 0.0002f },
+    /* REM   */ { 930.0f, 30.0f, 3.0f, 0.0005f },
+};
+
+/**
+* @brief   Synthetic night generator configuration
+*/
+typedef struct _bench_night_config {
+    float hours;        /**< Night length in hours */
+    float noise_ms;     /**< Beat-to-beat IBI jitter in ms */
+    float cycle_min;    /**< Sleep cycle length in minutes */
+    uint32_t seed;      /**< Generator seed */
+} bench_night_config;
+
+/**
+* @brief   Synthetic night generator state
+*/
+typedef struct _bench_night_gen {
+    bench_night_config cfg;
+    uint32_t rng;
+    uint32_t sample_idx;
+    uint32_t sample_count;
+    double next_beat_ms;
+    float last_ibi_ms;
+    float hr_smooth_bpm;
+} bench_night_gen;
+
+/**
+* @brief   Latency and result counters of a benchmark scenario
+*/
+typedef struct _bench_result {
+    const char *name;
+    uint32_t samples;
+    uint32_t hrv_windows;
+    uint32_t sleep_outputs;     /**< Sum of output_data_arr_length, one output per second */
+    double total_sec;           /**< Median over the repeats */
+    double total_sec_min;       /**< Fastest of the repeats */
+    double p50_us;
+    double p99_us;
+    double max_us;
+    long peak_rss_kb;   /**< Peak RSS of the child process that ran the scenario */
+} bench_result;
+
+static uint32_t bench_rand(uint32_t *state)
+{
+    /* xorshift32, deterministic across platforms */
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+/* Uniform in [-1, 1) */
+static float bench_rand_sym(uint32_t *state)
+{
+    return (float)(bench_rand(state) >> 8) * (2.0f / 16777216.0f) - 1.0f;
+}
+
+static float bench_rand_unit(uint32_t *state)
+{
+    return (float)(bench_rand(state) >> 8) * (1.0f / 16777216.0f);
+}
+
+/* Stage at a given second of the night: sleep onset after 20 min, wake-up
+ * during the last 15 min, cycles of LIGHT -> DEEP -> LIGHT -> REM with a
+ * short arousal at the end of each cycle. Deep sleep shrinks in later
+ * cycles and REM grows, as in a typical hypnogram. */
+static bench_stage bench_stage_at(const bench_night_config *cfg, uint32_t sec)
+{
+    const uint32_t onset_sec = 20 * 60;
+    const uint32_t night_sec = (uint32_t)(cfg->hours * 3600.0f);
+    const uint32_t cycle_sec = (uint32_t)(cfg->cycle_min * 60.0f);
+    uint32_t cycle_idx;
+    float pos;
+    float deep_frac;
+    float rem_frac;
+
+    if (sec < onset_sec || sec + 15 * 60 >= night_sec || cycle_sec == 0) {
+        return BENCH_STAGE_WAKE;
+    }
+
+    cycle_idx = (sec - onset_sec) / cycle_sec;
+    pos = (float)((sec - onset_sec) % cycle_sec) / (float)cycle_sec;
+    deep_frac = 0.35f - 0.07f * (float)cycle_idx;
+    if (deep_frac < 0.05f) {
+        deep_frac = 0.05f;
+    }
+    rem_frac = 0.15f + 0.05f * (float)cycle_idx;
+    if (rem_frac > 0.35f) {
+        rem_frac = 0.35f;
+    }
+
+    if (pos < 0.20f) {
+        return BENCH_STAGE_LIGHT;
+    } else if (pos < 0.20f + deep_frac) {
+        return BENCH_STAGE_DEEP;
+    } else if (pos < 0.97f - rem_frac) {
+        return BENCH_STAGE_LIGHT;
+    } else if (pos < 0.97f) {
+        return BENCH_STAGE_REM;
+    }
+    return BENCH_STAGE_WAKE;
+}
+
+static void bench_night_gen_init(bench_night_gen *gen, const bench_night_config *cfg)
+{
+    memset(gen, 0, sizeof(*gen));
+    gen->cfg = *cfg;
+    gen->rng = cfg->seed ? cfg->seed : 1u;
+    gen->sample_count = (uint32_t)(cfg->hours * 3600.0f) * BENCH_SAMPLES_PER_SEC;
+    gen->last_ibi_ms = bench_profiles[BENCH_STAGE_WAKE].mean_ibi_ms;
+    gen->next_beat_ms = gen->last_ibi_ms;
+    gen->hr_smooth_bpm = 60000.0f / gen->last_ibi_ms;
+}
+
+/* Fills the next 25 Hz sample. Returns false once the night is over. */
+static bool bench_night_gen_next(bench_night_gen *gen, mxm_algosuite_input_data *sample)
+{
+    const double t_ms = (double)gen->sample_idx * BENCH_SAMPLE_PERIOD_MS;
+    const bench_stage stage = bench_stage_at(&gen->cfg, gen->sample_idx / BENCH_SAMPLES_PER_SEC);
+    const bench_stage_profile *prof = &bench_profiles[stage];
+    uint64_t timestamp;
+    float motion;
+
+    if (gen->sample_idx >= gen->sample_count) {
+        return false;
+    }
+
+    memset(sample, 0, sizeof(*sample));
+    sample->inp_sample_count = gen->sample_idx;
+    sample->grn_count = 150000 + (bench_rand(&gen->rng) & 0x3FF);
+    sample->grn2Cnt = sample->grn_count;
+
+    motion = prof->motion_mg;
+    if (bench_rand_unit(&gen->rng) < prof->motion_burst_prob) {
+        motion *= 20.0f;
+    }
+    sample->accelx = (int32_t)(motion * bench_rand_sym(&gen->rng));
+    sample->accely = (int32_t)(motion * bench_rand_sym(&gen->rng));
+    sample->accelz = BENCH_ACC_1G + (int32_t)(motion * bench_rand_sym(&gen->rng));
+
+    if (t_ms + BENCH_SAMPLE_PERIOD_MS > gen->next_beat_ms) {
+        /* Breathing at ~15/min modulates the beat intervals */
+        const float rsa = prof->rsa_depth_ms * (float)sin(gen->next_beat_ms * (2.0 * 3.14159265358979 / 4000.0));
+        float ibi = prof->mean_ibi_ms + rsa + gen->cfg.noise_ms * bench_rand_sym(&gen->rng);
+
+        /* Stage transitions are smoothed over a few beats */
+        ibi = 0.8f * gen->last_ibi_ms + 0.2f * ibi;
+        if (ibi < BENCH_MIN_IBI_MS) {
+            ibi = BENCH_MIN_IBI_MS;
+        } else if (ibi > BENCH_MAX_IBI_MS) {
+            ibi = BENCH_MAX_IBI_MS;
+        }
+        gen->last_ibi_ms = ibi;
+        gen->next_beat_ms += ibi;
+
+        sample->rr_interbeat_interval = (uint32_t)(ibi * BENCH_HUB_SCALE);
+        sample->rr_confidence = 100;
+    }
+
+    gen->hr_smooth_bpm += 0.05f * (60000.0f / gen->last_ibi_ms - gen->hr_smooth_bpm);
+    sample->hearth_rate_estim = (uint32_t)(gen->hr_smooth_bpm * BENCH_HUB_SCALE);
+    sample->hr_confidence = 100;
+    sample->activity_class = (stage == BENCH_STAGE_WAKE) ? 1 : 0;
+    sample->skin_contact_state = 1;
+
+    timestamp = BENCH_START_TIMESTAMP_MS + (uint64_t)t_ms;
+    sample->timestampUpper32bit = (uint32_t)(timestamp >> 32);
+    sample->timestampLower32bit = (uint32_t)timestamp;
+
+    gen->sample_idx++;
+    return true;
+}
+
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int bench_cmp_u32(const void *a, const void *b)
+{
+    const uint32_t x = *(const uint32_t *)a;
+    const uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void bench_default_init_data(mxm_algosuite_init_data *init)
+{
+    memset(init, 0, sizeof(*init));
+    init->hrvConfig.samplingPeriod = (float)BENCH_SAMPLE_PERIOD_MS;
+    init->hrvConfig.metricCalcCfg.longTermMetricCalcPeriodInHour = 1.0f;
+    init->hrvConfig.metricCalcCfg.windowSizeInSec = 300;
+    init->hrvConfig.metricCalcCfg.windowShiftSizeInSec = 60;
+    init->hrvConfig.metricCalcCfg.sampleEntropy_m = 2;
+    init->hrvConfig.metricCalcCfg.sampleEntropy_r = 20.0f;
+
+    init->sleepConfig.mxm_sleep_detection_duration = MXM_SLEEP_MANAGER_MINIMUM_SLEEP_30_MIN;
+    init->sleepConfig.user_info.age = 35;
+    init->sleepConfig.user_info.weight = 75;
+    init->sleepConfig.user_info.gender = MXM_MALE;
+    init->sleepConfig.is_confidence_level_available_hr = true;
+    init->sleepConfig.is_confidence_level_available_ibi = true;
+}
+
+/* Runs one night in the calling process. A NULL init skips the library
+ * calls and keeps everything else, which gives the benchmark's own
+ * footprint (generator, latency buffer and the qsort scratch buffer). */
+static bool bench_run_in_process(const char *name,
+                                 const mxm_algosuite_init_data *init,
+                                 const bench_night_config *night,
+                                 uint32_t *lat_ns,
+                                 bench_result *res)
+{
+    bench_night_gen gen;
+    mxm_algosuite_input_data sample;
+    mxm_algosuite_output_data out;
+    mxm_algosuite_return_code status;
+    uint64_t total_ns = 0;
+    uint32_t n = 0;
+
+    memset(res, 0, sizeof(*res));
+    res->name = name;
+
+    if (init != NULL) {
+        mxm_algosuite_manager_init(init, &status);
+        if (((init->enabledAlgorithms & MXM_ALGOSUITE_ENABLE_HRV) && status.hrv_status != MXM_HRV_SUCCESS) ||
+            ((init->enabledAlgorithms & MXM_ALGOSUITE_ENABLE_SLEEP) && status.sleep_status != MXM_SLEEP_MANAGER_SUCCESS)) {
+            fprintf(stderr, "%s: init failed (hrv %d, sleep %d)\n", name, status.hrv_status, status.sleep_status);
+            mxm_algosuite_manager_end(init->enabledAlgorithms, &status);
+            return false;
+        }
+    }
+
+    bench_night_gen_init(&gen, night);
+    while (bench_night_gen_next(&gen, &sample)) {
+        uint64_t t0;
+        uint64_t dt;
+
+        memset(&out, 0, sizeof(out));
+        t0 = bench_now_ns();
+        if (init != NULL) {
+            mxm_algosuite_manager_run(&sample, &out, &status);
+        }
+        dt = bench_now_ns() - t0;
+
+        total_ns += dt;
+        lat_ns[n++] = (dt > UINT32_MAX) ? UINT32_MAX : (uint32_t)dt;
+
+        if (out.hrv_out_sample.shortTermMetrics.isShortTermHrvCalculated) {
+            res->hrv_windows++;
+        }
+        res->sleep_outputs += out.sleep_out_Sample.output_data_arr_length;
+    }
+
+    if (init != NULL) {
+        mxm_algosuite_manager_end(init->enabledAlgorithms, &status);
+    }
+
+    res->samples = n;
+    res->total_sec = (double)total_ns * 1e-9;
+    if (n > 0) {
+        qsort(lat_ns, n, sizeof(lat_ns[0]), bench_cmp_u32);
+        res->p50_us = lat_ns[(n - 1) / 2] * 1e-3;
+        res->p99_us = lat_ns[(uint32_t)((uint64_t)(n - 1) * 99 / 100)] * 1e-3;
+        res->max_us = lat_ns[n - 1] * 1e-3;
+    }
+    return true;
+}
+
+/* Runs bench_run_in_process in a forked child and takes the child's peak
+ * RSS from wait4, so scenarios do not inherit each other's high-water mark.
+ * The child's result comes back over a pipe. */
+static bool bench_run_forked(const char *name,
+                             const mxm_algosuite_init_data *init,
+                             const bench_night_config *night,
+                             uint32_t *lat_ns,
+                             bench_result *res)
+{
+    struct rusage usage;
+    size_t got = 0;
+    int fds[2];
+    int wstatus;
+    pid_t pid;
+
+    memset(res, 0, sizeof(*res));
+    res->name = name;
+
+    if (pipe(fds) != 0) {
+        perror("pipe");
+        return false;
+    }
+
+    pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        close(fds[0]);
+        close(fds[1]);
+        return false;
+    }
+
+    if (pid == 0) {
+        const bool ok = bench_run_in_process(name, init, night, lat_ns, res);
+        const char *p = (const char *)res;
+        size_t left = sizeof(*res);
+
+        close(fds[0]);
+        while (ok && left > 0) {
+            const ssize_t w = write(fds[1], p, left);
+            if (w <= 0) {
+                _exit(1);
+            }
+            p += w;
+            left -= (size_t)w;
+        }
+        _exit(ok ? 0 : 1);
+    }
+
+    close(fds[1]);
+    while (got < sizeof(*res)) {
+        const ssize_t r = read(fds[0], (char *)res + got, sizeof(*res) - got);
+        if (r <= 0) {
+            break;
+        }
+        got += (size_t)r;
+    }
+    close(fds[0]);
+
+    if (wait4(pid, &wstatus, 0, &usage) != pid) {
+        perror("wait4");
+        return false;
+    }
+    if (!WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0 || got != sizeof(*res)) {
+        fprintf(stderr, "%s: scenario process failed\n", name);
+        res->samples = 0;
+        return false;
+    }
+    res->peak_rss_kb = usage.ru_maxrss;
+    return true;
+}
+
+static int bench_cmp_total_sec(const void *a, const void *b)
+{
+    const double x = ((const bench_result *)a)->total_sec;
+    const double y = ((const bench_result *)b)->total_sec;
+    return (x > y) - (x < y);
+}
+
+/* Single runs are too noisy to compare scenarios against each other, so
+ * the scenario is run `repeats` times and the median run is reported. */
+static bool bench_run_scenario(const char *name,
+                               const mxm_algosuite_init_data *init,
+                               const bench_night_config *night,
+                               int repeats,
+                               uint32_t *lat_ns,
+                               bench_result *res)
+{
+    bench_result runs[BENCH_MAX_REPEATS];
+    long peak_rss_kb = 0;
+    int i;
+
+    for (i = 0; i < repeats; i++) {
+        if (!bench_run_forked(name, init, night, lat_ns, &runs[i])) {
+            *res = runs[i];
+            return false;
+        }
+        if (runs[i].peak_rss_kb > peak_rss_kb) {
+            peak_rss_kb = runs[i].peak_rss_kb;
+        }
+    }
+
+    qsort(runs, (size_t)repeats, sizeof(runs[0]), bench_cmp_total_sec);
+    *res = runs[(repeats - 1) / 2];
+    res->total_sec_min = runs[0].total_sec;
+    res->peak_rss_kb = peak_rss_kb;
+    return true;
+}
+
+static void bench_print_json(FILE *fp,
+                             const mxm_algosuite_version_str *ver,
+                             const bench_night_config *night,
+                             const bench_result *baseline,
+                             int repeats,
+                             const bench_result *res,
+                             int res_count)
+{
+    int i;
+
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"library_version\": \"%s\",\n", ver->version_string);
+    fprintf(fp, "  \"night\": {\"hours\": %.3f, \"noise_ms\": %.3f, \"cycle_min\": %.3f, \"seed\": %u, "
+                "\"sample_rate_hz\": %d},\n",
+            night->hours, night->noise_ms, night->cycle_min, night->seed, BENCH_SAMPLES_PER_SEC);
+    fprintf(fp, "  \"repeats\": %d,\n", repeats);
+    fprintf(fp, "  \"baseline_peak_rss_kb\": %ld,\n", baseline->peak_rss_kb);
+    fprintf(fp, "  \"scenarios\": [\n");
+    for (i = 0; i < res_count; i++) {
+        const bench_result *r = &res[i];
+        const double tput = (r->total_sec > 0.0) ? r->samples / r->total_sec : 0.0;
+        fprintf(fp, "    {\"name\": \"%s\", \"samples\": %u, \"total_sec\": %.6f, \"total_sec_min\": %.6f, "
+                    "\"throughput_samples_per_sec\": %.1f, \"nights_per_sec\": %.4f, "
+                    "\"latency_us\": {\"p50\": %.3f, \"p99\": %.3f, \"max\": %.3f}, "
+                    "\"hrv_windows\": %u, \"sleep_outputs\": %u, \"peak_rss_kb\": %ld}%s\n",
+                r->name, r->samples, r->total_sec, r->total_sec_min, tput,
+                (r->total_sec > 0.0) ? 1.0 / r->total_sec : 0.0,
+                r->p50_us, r->p99_us, r->max_us,
+                r->hrv_windows, r->sleep_outputs, r->peak_rss_kb,
+                (i + 1 < res_count) ? "," : "");
+    }
+    fprintf(fp, "  ]\n}\n");
+}
+
+int main(int argc, char **argv)
+{
+    bench_night_config night = { 8.0f, 15.0f, 90.0f, 12345u };
+    const char *out_path = NULL;
+    mxm_algosuite_version_str ver;
+    mxm_algosuite_init_data init;
+    bench_result baseline;
+    bench_result res[8];
+    uint32_t *lat_ns;
+    uint32_t max_samples;
+    int repeats = 1;
+    int res_count = 0;
+    int failed = 0;
+    int opt;
+    FILE *fp = stdout;
+
+    while ((opt = getopt(argc, argv, "h:n:c:s:r:o:")) != -1) {
+        switch (opt) {
+        case 'h': night.hours = strtof(optarg, NULL); break;
+        case 'n': night.noise_ms = strtof(optarg, NULL); break;
+        case 'c': night.cycle_min = strtof(optarg, NULL); break;
+        case 's': night.seed = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'r': repeats = (int)strtol(optarg, NULL, 10); break;
+        case 'o': out_path = optarg; break;
+        default:
+            fprintf(stderr, "usage: %s [-h hours] [-n noise_ms] [-c cycle_min] [-s seed] [-r repeats] [-o output.json]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+    /* isfinite() first: every comparison against NaN is false */
+    if (!isfinite(night.hours) || !isfinite(night.noise_ms) || !isfinite(night.cycle_min) ||
+        night.hours <= 0.0f || night.hours > BENCH_MAX_HOURS ||
+        night.noise_ms < 0.0f || night.noise_ms > BENCH_MAX_NOISE_MS ||
+        night.cycle_min <= 0.0f || night.cycle_min > BENCH_MAX_HOURS * 60.0f) {
+        fprintf(stderr, "invalid night configuration (hours must be in (0, %.0f], noise_ms in [0, %.0f])\n",
+                BENCH_MAX_HOURS, BENCH_MAX_NOISE_MS);
+        return 2;
+    }
+    if (repeats < 1 || repeats > BENCH_MAX_REPEATS) {
+        fprintf(stderr, "repeats must be in [1, %d]\n", BENCH_MAX_REPEATS);
+        return 2;
+    }
+
+    max_samples = (uint32_t)(night.hours * 3600.0f) * BENCH_SAMPLES_PER_SEC;
+    /* calloc checks the size overflow on 32-bit ABIs */
+    lat_ns = (uint32_t *)calloc((size_t)max_samples + 1, sizeof(*lat_ns));
+    if (lat_ns == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    mxm_algosuite_manager_get_versions(&ver);
+
+    /* Generator and latency buffer only, without the library. Repeated like
+     * the scenarios so that both peak RSS values are the max over -r runs. */
+    failed |= !bench_run_scenario("baseline", NULL, &night, repeats, lat_ns, &baseline);
+
+    /* Full suite as deployed: time and frequency domain HRV alongside sleep staging */
+    bench_default_init_data(&init);
+    init.enabledAlgorithms = MXM_ALGOSUITE_ENABLE_HRV | MXM_ALGOSUITE_ENABLE_SLEEP;
+    init.hrvConfig.metricCalcCfg.isTimeDomAndLongTermCalcActive = true;
+    init.hrvConfig.metricCalcCfg.isFreqDomCalcActive = true;
+    failed |= !bench_run_scenario("algosuite_hrv_sleep", &init, &night, repeats, lat_ns, &res[res_count++]);
+
+    /* Sleep manager alone, one night per run */
+    bench_default_init_data(&init);
+    init.enabledAlgorithms = MXM_ALGOSUITE_ENABLE_SLEEP;
+    failed |= !bench_run_scenario("sleep_night", &init, &night, repeats, lat_ns, &res[res_count++]);
+
+    /* HRV configured as in the full suite, without sleep. Its share of
+     * algosuite_hrv_sleep bounds the work HRV and sleep could share; use
+     * -r so the difference is above the run-to-run noise. */
+    bench_default_init_data(&init);
+    init.enabledAlgorithms = MXM_ALGOSUITE_ENABLE_HRV;
+    init.hrvConfig.metricCalcCfg.isTimeDomAndLongTermCalcActive = true;
+    init.hrvConfig.metricCalcCfg.isFreqDomCalcActive = true;
+    failed |= !bench_run_scenario("hrv_for_sleep", &init, &night, repeats, lat_ns, &res[res_count++]);
+
+    /* HRV with each metric group toggled on its own */
+    bench_default_init_data(&init);
+    init.enabledAlgorithms = MXM_ALGOSUITE_ENABLE_HRV;
+    init.hrvConfig.metricCalcCfg.isTimeDomAndLongTermCalcActive = true;
+    failed |= !bench_run_scenario("hrv_time_domain", &init, &night, repeats, lat_ns, &res[res_count++]);
+
+    bench_default_init_data(&init);
+    init.enabledAlgorithms = MXM_ALGOSUITE_ENABLE_HRV;
+    init.hrvConfig.metricCalcCfg.isFreqDomCalcActive = true;
+    failed |= !bench_run_scenario("hrv_freq_domain", &init, &night, repeats, lat_ns, &res[res_count++]);
+
+    bench_default_init_data(&init);
+    init.enabledAlgorithms = MXM_ALGOSUITE_ENABLE_HRV;
+    init.hrvConfig.metricCalcCfg.isSampleEntropyCalcActive = true;
+    failed |= !bench_run_scenario("hrv_sample_entropy", &init, &night, repeats, lat_ns, &res[res_count++]);
+
+    free(lat_ns);
+
+    if (out_path != NULL) {
+        fp = fopen(out_path, "w");
+        if (fp == NULL) {
+            perror(out_path);
+            return 1;
+        }
+    }
+    bench_print_json(fp, &ver, &night, &baseline, repeats, res, res_count);
+    if (fp != stdout) {
+        fclose(fp);
+    }
+
+    return failed ? 1 : 0;
+}